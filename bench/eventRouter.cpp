@@ -0,0 +1,149 @@
+/*
+ * Host microbenchmark: dispatch latency of core::EventRouter against the two
+ * approaches it replaces, over the stubbed esp_event loop in bench/stub:
+ *  - a hand-written C handler with a switch and void * casts;
+ *  - esp_event_cxx-style per-id registration of heap-allocated std::function.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../event.hpp"
+
+namespace {
+
+constexpr std::size_t iterations = 2'000'000;
+
+volatile std::uint64_t sink = 0;
+
+void onDisconnected( const wifi_event_sta_disconnected_t & e ) noexcept { sink = sink + e.reason; }
+void onGotIp( const ip_event_got_ip_t & e ) noexcept { sink = sink + e.ip_info.ip; }
+void onLostIp( const ip_event_got_ip_t & ) noexcept { sink = sink + 1; }
+
+struct Post final {
+    esp_event_base_t base;
+    int32_t          id;
+    void *           data;
+};
+
+double measure( const std::vector< Post > & posts ) {
+    const auto begin = std::chrono::steady_clock::now();
+    for ( std::size_t i = 0; i < iterations; ++i ) {
+        const Post & p = posts[ i % posts.size() ];
+        esp_event_stub_post( p.base, p.id, p.data );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration< double, std::nano >( end - begin ).count() / iterations;
+}
+
+void cHandler( void *, esp_event_base_t base, int32_t id, void * data ) {
+    if ( base == WIFI_EVENT ) {
+        switch ( id ) {
+        case WIFI_EVENT_STA_DISCONNECTED:
+            onDisconnected( *static_cast< wifi_event_sta_disconnected_t * >( data ) );
+            break;
+        default:
+            break;
+        }
+    } else if ( base == IP_EVENT ) {
+        switch ( id ) {
+        case IP_EVENT_STA_GOT_IP:
+            onGotIp( *static_cast< ip_event_got_ip_t * >( data ) );
+            break;
+        case IP_EVENT_STA_LOST_IP:
+            onLostIp( *static_cast< ip_event_got_ip_t * >( data ) );
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+using Callback = std::function< void( esp_event_base_t, int32_t, void * ) >;
+
+void functionTrampoline( void * arg, esp_event_base_t base, int32_t id, void * data ) {
+    ( *static_cast< Callback * >( arg ) )( base, id, data );
+}
+
+using Router = core::EventRouter< core::On< WIFI_EVENT_STA_DISCONNECTED, onDisconnected >,
+                                  core::On< IP_EVENT_STA_GOT_IP, onGotIp >,
+                                  core::On< IP_EVENT_STA_LOST_IP, onLostIp > >;
+
+void checkRollback() {
+    esp_event_stub_fail_after = 1;
+    try {
+        Router::registerHandlers();
+        std::fputs( "registerHandlers did not throw\n", stderr );
+        std::exit( EXIT_FAILURE );
+    } catch ( const std::runtime_error & ) {
+    }
+    esp_event_stub_fail_after = -1;
+
+    if ( !esp_event_stub_entries.empty() ) {
+        std::fputs( "registerHandlers left a handler registered after failure\n", stderr );
+        std::exit( EXIT_FAILURE );
+    }
+}
+
+}   // namespace
+
+int main() {
+    wifi_event_sta_disconnected_t disconnected {};
+    ip_event_got_ip_t             gotIp {};
+    wifi_event_sta_connected_t    connected {};
+    disconnected.reason = 8;
+    gotIp.ip_info.ip    = 1;
+
+    const std::vector< Post > posts { { WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &disconnected },
+                                      { IP_EVENT, IP_EVENT_STA_GOT_IP, &gotIp },
+                                      { IP_EVENT, IP_EVENT_STA_LOST_IP, &gotIp },
+                                      { WIFI_EVENT, WIFI_EVENT_STA_CONNECTED, &connected } };
+
+    checkRollback();
+
+    esp_event_handler_register( WIFI_EVENT, ESP_EVENT_ANY_ID, &cHandler, nullptr );
+    esp_event_handler_register( IP_EVENT, ESP_EVENT_ANY_ID, &cHandler, nullptr );
+    const double cNs = measure( posts );
+    esp_event_stub_entries.clear();
+
+    std::vector< std::unique_ptr< Callback > > callbacks;
+
+    const auto registerFunction = [ & ]( esp_event_base_t base, int32_t id, Callback cb ) {
+        callbacks.push_back( std::make_unique< Callback >( std::move( cb ) ) );
+        esp_event_handler_register( base, id, &functionTrampoline, callbacks.back().get() );
+    };
+    registerFunction( WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, []( esp_event_base_t, int32_t, void * data ) {
+        onDisconnected( *static_cast< wifi_event_sta_disconnected_t * >( data ) );
+    } );
+    registerFunction( IP_EVENT, IP_EVENT_STA_GOT_IP, []( esp_event_base_t, int32_t, void * data ) {
+        onGotIp( *static_cast< ip_event_got_ip_t * >( data ) );
+    } );
+    registerFunction( IP_EVENT, IP_EVENT_STA_LOST_IP, []( esp_event_base_t, int32_t, void * data ) {
+        onLostIp( *static_cast< ip_event_got_ip_t * >( data ) );
+    } );
+    const double functionNs = measure( posts );
+    esp_event_stub_entries.clear();
+
+    const std::uint64_t before = sink;
+    Router::registerHandlers();
+    const double routerNs = measure( posts );
+    Router::unregisterHandlers();
+
+    if ( sink == before || !esp_event_stub_entries.empty() ) {
+        std::fputs( "EventRouter did not dispatch or did not unregister\n", stderr );
+        return EXIT_FAILURE;
+    }
+
+    std::printf( "%-24s %8.2f ns/event\n", "C switch + void *", cNs );
+    std::printf( "%-24s %8.2f ns/event\n", "std::function per id", functionNs );
+    std::printf( "%-24s %8.2f ns/event\n", "core::EventRouter", routerNs );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/*
+ * Host run of core::Iperf against an in-process loopback peer: a TCP sink,
+ * a UDP sink and a UDP echo on 127.0.0.1. Checks the harness end to end;
+ * per-profile numbers come from Connect::WifiIperf on the device.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include <lwip/sockets.h>
+#include <unistd.h>
+
+#include "../iperf.hpp"
+
+namespace {
+
+std::atomic< bool > stopping { false };
+
+int bindLoopback( int type, std::uint16_t & port ) {
+    const int sock = socket( AF_INET, type, 0 );
+
+    sockaddr_in addr {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    socklen_t len        = sizeof( addr );
+    if ( sock < 0 || bind( sock, reinterpret_cast< sockaddr * >( &addr ), sizeof( addr ) ) < 0 ||
+         getsockname( sock, reinterpret_cast< sockaddr * >( &addr ), &len ) < 0 ||
+         ( type == SOCK_STREAM && listen( sock, 1 ) < 0 ) ) {
+        std::perror( "loopback peer" );
+        std::exit( EXIT_FAILURE );
+    }
+
+    const timeval timeout { .tv_sec = 0, .tv_usec = 100'000 };
+    setsockopt( sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof( timeout ) );
+
+    port = ntohs( addr.sin_port );
+    return sock;
+}
+
+void tcpSink( int listener ) {
+    char buf[ 16 * 1024 ];
+    while ( !stopping ) {
+        const int conn = accept( listener, nullptr, nullptr );
+        if ( conn < 0 )
+            continue;
+        while ( recv( conn, buf, sizeof( buf ), 0 ) > 0 ) {}
+        close( conn );
+    }
+    close( listener );
+}
+
+void udpPeer( int sock, bool echo ) {
+    char buf[ 2048 ];
+    while ( !stopping ) {
+        sockaddr_in from {};
+        socklen_t   len = sizeof( from );
+        const auto  n   = recvfrom( sock, buf, sizeof( buf ), 0, reinterpret_cast< sockaddr * >( &from ), &len );
+        if ( n > 0 && echo )
+            sendto( sock, buf, static_cast< std::size_t >( n ), 0, reinterpret_cast< sockaddr * >( &from ), len );
+    }
+    close( sock );
+}
+
+}   // namespace
+
+int main() {
+    core::Iperf::Peer peer { .address = "127.0.0.1" };
+
+    std::thread tcp( tcpSink, bindLoopback( SOCK_STREAM, peer.tcpPort ) );
+    std::thread udp( udpPeer, bindLoopback( SOCK_DGRAM, peer.udpPort ), false );
+    std::thread echo( udpPeer, bindLoopback( SOCK_DGRAM, peer.echoPort ), true );
+
+    const core::Iperf::Settings settings { .duration = std::chrono::milliseconds( 500 ), .latencySamples = 1000 };
+
+    int status = EXIT_SUCCESS;
+    try {
+        const core::Iperf::Report report = core::Iperf::run( peer, settings );
+
+        std::printf( "TCP %10.1f Mbit/s\n", report.tcpMbps );
+        std::printf( "UDP %10.1f Mbit/s\n", report.udpMbps );
+        std::printf( "RTT p50 %lld us, p90 %lld us, p99 %lld us, max %lld us, lost %zu\n",
+                     static_cast< long long >( report.udpRtt.p50.count() ),
+                     static_cast< long long >( report.udpRtt.p90.count() ),
+                     static_cast< long long >( report.udpRtt.p99.count() ),
+                     static_cast< long long >( report.udpRtt.max.count() ),
+                     report.udpRtt.lost );
+
+        if ( report.tcpMbps <= 0 || report.udpMbps <= 0 || report.udpRtt.lost == settings.latencySamples )
+            status = EXIT_FAILURE;
+    } catch ( const std::exception & e ) {
+        std::fprintf( stderr, "%s\n", e.what() );
+        status = EXIT_FAILURE;
+    }
+
+    stopping = true;
+    tcp.join();
+    udp.join();
+    echo.join();
+
+    return status;
+}
@@ -0,0 +1,44 @@
+#pragma once
+/* Host stand-in for the default esp_event loop: a flat registration list walked on every post */
+
+#include <cstdint>
+#include <vector>
+
+typedef int         esp_err_t;
+typedef const char * esp_event_base_t;
+typedef void ( *esp_event_handler_t )( void *, esp_event_base_t, int32_t, void * );
+
+#define ESP_OK           0
+#define ESP_FAIL         -1
+#define ESP_EVENT_ANY_ID -1
+
+struct esp_event_stub_entry_t {
+    esp_event_base_t    base;
+    int32_t             id;
+    esp_event_handler_t handler;
+    void *              arg;
+};
+
+inline std::vector< esp_event_stub_entry_t > esp_event_stub_entries;
+inline int                                   esp_event_stub_fail_after = -1;
+
+inline esp_err_t esp_event_handler_register( esp_event_base_t base, int32_t id, esp_event_handler_t h, void * arg ) {
+    if ( esp_event_stub_fail_after == 0 )
+        return ESP_FAIL;
+    if ( esp_event_stub_fail_after > 0 )
+        --esp_event_stub_fail_after;
+    esp_event_stub_entries.push_back( { base, id, h, arg } );
+    return ESP_OK;
+}
+
+inline esp_err_t esp_event_handler_unregister( esp_event_base_t base, int32_t id, esp_event_handler_t h ) {
+    std::erase_if( esp_event_stub_entries,
+                   [ & ]( const auto & e ) { return e.base == base && e.id == id && e.handler == h; } );
+    return ESP_OK;
+}
+
+inline void esp_event_stub_post( esp_event_base_t base, int32_t id, void * data ) {
+    for ( const auto & e : esp_event_stub_entries )
+        if ( e.base == base && ( e.id == ESP_EVENT_ANY_ID || e.id == id ) )
+            e.handler( e.arg, base, id, data );
+}
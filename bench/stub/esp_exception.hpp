@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdexcept>
+
+#define CHECK_THROW( err )                                                                                             \
+    do {                                                                                                               \
+        if ( ( err ) != 0 )                                                                                            \
+            throw std::runtime_error( #err );                                                                          \
+    } while ( 0 )
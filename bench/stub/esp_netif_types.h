@@ -0,0 +1,21 @@
+#pragma once
+
+#include "esp_event.h"
+
+inline const esp_event_base_t IP_EVENT = "IP_EVENT";
+
+typedef enum {
+    IP_EVENT_STA_GOT_IP,
+    IP_EVENT_STA_LOST_IP,
+    IP_EVENT_AP_STAIPASSIGNED,
+    IP_EVENT_GOT_IP6,
+    IP_EVENT_ETH_GOT_IP,
+    IP_EVENT_ETH_LOST_IP,
+    IP_EVENT_PPP_GOT_IP,
+    IP_EVENT_PPP_LOST_IP,
+} ip_event_t;
+
+struct esp_netif_ip_info_t { uint32_t ip, netmask, gw; };
+struct ip_event_got_ip_t { void * esp_netif; esp_netif_ip_info_t ip_info; bool ip_changed; };
+struct ip_event_got_ip6_t { void * esp_netif; int ip_index; };
+struct ip_event_ap_staipassigned_t { void * esp_netif; uint32_t ip; uint8_t mac[ 6 ]; };
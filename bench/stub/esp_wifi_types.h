@@ -0,0 +1,83 @@
+#pragma once
+
+#include "esp_event.h"
+
+inline const esp_event_base_t WIFI_EVENT = "WIFI_EVENT";
+
+typedef enum {
+    WIFI_EVENT_WIFI_READY,
+    WIFI_EVENT_SCAN_DONE,
+    WIFI_EVENT_STA_START,
+    WIFI_EVENT_STA_STOP,
+    WIFI_EVENT_STA_CONNECTED,
+    WIFI_EVENT_STA_DISCONNECTED,
+    WIFI_EVENT_STA_AUTHMODE_CHANGE,
+    WIFI_EVENT_STA_WPS_ER_SUCCESS,
+    WIFI_EVENT_STA_WPS_ER_FAILED,
+    WIFI_EVENT_STA_WPS_ER_TIMEOUT,
+    WIFI_EVENT_STA_WPS_ER_PIN,
+    WIFI_EVENT_STA_WPS_ER_PBC_OVERLAP,
+    WIFI_EVENT_AP_START,
+    WIFI_EVENT_AP_STOP,
+    WIFI_EVENT_AP_STACONNECTED,
+    WIFI_EVENT_AP_STADISCONNECTED,
+    WIFI_EVENT_AP_PROBEREQRECVED,
+    WIFI_EVENT_FTM_REPORT,
+    WIFI_EVENT_STA_BSS_RSSI_LOW,
+    WIFI_EVENT_ACTION_TX_STATUS,
+    WIFI_EVENT_ROC_DONE,
+    WIFI_EVENT_STA_BEACON_TIMEOUT,
+    WIFI_EVENT_CONNECTIONLESS_MODULE_WAKE_INTERVAL_START,
+    WIFI_EVENT_AP_WPS_RG_SUCCESS,
+    WIFI_EVENT_AP_WPS_RG_FAILED,
+    WIFI_EVENT_AP_WPS_RG_TIMEOUT,
+    WIFI_EVENT_AP_WPS_RG_PIN,
+    WIFI_EVENT_AP_WPS_RG_PBC_OVERLAP,
+    WIFI_EVENT_ITWT_SETUP,
+    WIFI_EVENT_ITWT_TEARDOWN,
+    WIFI_EVENT_ITWT_PROBE,
+    WIFI_EVENT_ITWT_SUSPEND,
+    WIFI_EVENT_NAN_STARTED,
+    WIFI_EVENT_NAN_STOPPED,
+    WIFI_EVENT_NAN_SVC_MATCH,
+    WIFI_EVENT_NAN_REPLIED,
+    WIFI_EVENT_NAN_RECEIVE,
+    WIFI_EVENT_NDP_INDICATION,
+    WIFI_EVENT_NDP_CONFIRM,
+    WIFI_EVENT_NDP_TERMINATED,
+    WIFI_EVENT_HOME_CHANNEL_CHANGE,
+    WIFI_EVENT_STA_NEIGHBOR_REP,
+    WIFI_EVENT_MAX,
+} wifi_event_t;
+
+struct wifi_event_sta_disconnected_t {
+    uint8_t ssid[ 32 ];
+    uint8_t ssid_len;
+    uint8_t bssid[ 6 ];
+    uint8_t reason;
+    int8_t  rssi;
+};
+struct wifi_event_sta_scan_done_t { int dummy; };
+struct wifi_event_sta_connected_t { int dummy; };
+struct wifi_event_sta_authmode_change_t { int dummy; };
+struct wifi_event_sta_wps_er_success_t { int dummy; };
+struct wifi_event_sta_wps_er_pin_t { int dummy; };
+struct wifi_event_ap_staconnected_t { int dummy; };
+struct wifi_event_ap_stadisconnected_t { int dummy; };
+struct wifi_event_ap_probe_req_rx_t { int dummy; };
+struct wifi_event_ftm_report_t { int dummy; };
+struct wifi_event_bss_rssi_low_t { int dummy; };
+struct wifi_event_action_tx_status_t { int dummy; };
+struct wifi_event_roc_done_t { int dummy; };
+struct wifi_event_ap_wps_rg_success_t { int dummy; };
+struct wifi_event_ap_wps_rg_pin_t { int dummy; };
+struct wifi_event_nan_svc_match_t { int dummy; };
+struct wifi_event_nan_replied_t { int dummy; };
+struct wifi_event_nan_receive_t { int dummy; };
+struct wifi_event_ndp_indication_t { int dummy; };
+struct wifi_event_ndp_confirm_t { int dummy; };
+struct wifi_event_ndp_terminated_t { int dummy; };
+struct wifi_event_home_channel_change_t { int dummy; };
+struct wifi_event_neighbor_report_t { int dummy; };
+typedef int wifi_event_sta_wps_fail_reason_t;
+typedef int wifi_event_ap_wps_rg_fail_reason_t;
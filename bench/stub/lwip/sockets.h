@@ -0,0 +1,7 @@
+#pragma once
+/* Host stand-in for lwIP's BSD socket API */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
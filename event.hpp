@@ -0,0 +1,236 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <esp_event.h>
+#include <esp_exception.hpp>
+#include <esp_idf_version.h>
+#include <esp_netif_types.h>
+#include <esp_wifi_types.h>
+
+namespace core {
+
+/*!< Payload type carried by an event id. Unmapped ids are rejected at compile time */
+template < auto Id > struct EventPayload;
+
+#define CORE_EVENT_PAYLOAD( id, payload )                                                                              \
+    template <> struct EventPayload< id > final {                                                                     \
+        using type = payload;                                                                                          \
+    }
+
+/*!< WIFI_EVENT */
+CORE_EVENT_PAYLOAD( WIFI_EVENT_WIFI_READY, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_SCAN_DONE, wifi_event_sta_scan_done_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_START, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_STOP, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_CONNECTED, wifi_event_sta_connected_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_DISCONNECTED, wifi_event_sta_disconnected_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_AUTHMODE_CHANGE, wifi_event_sta_authmode_change_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_WPS_ER_SUCCESS, wifi_event_sta_wps_er_success_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_WPS_ER_FAILED, wifi_event_sta_wps_fail_reason_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_WPS_ER_TIMEOUT, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_WPS_ER_PIN, wifi_event_sta_wps_er_pin_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_WPS_ER_PBC_OVERLAP, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_START, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_STOP, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_STACONNECTED, wifi_event_ap_staconnected_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_STADISCONNECTED, wifi_event_ap_stadisconnected_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_PROBEREQRECVED, wifi_event_ap_probe_req_rx_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_FTM_REPORT, wifi_event_ftm_report_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_BSS_RSSI_LOW, wifi_event_bss_rssi_low_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_ACTION_TX_STATUS, wifi_event_action_tx_status_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_ROC_DONE, wifi_event_roc_done_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_BEACON_TIMEOUT, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_CONNECTIONLESS_MODULE_WAKE_INTERVAL_START, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_WPS_RG_SUCCESS, wifi_event_ap_wps_rg_success_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_WPS_RG_FAILED, wifi_event_ap_wps_rg_fail_reason_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_WPS_RG_TIMEOUT, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_WPS_RG_PIN, wifi_event_ap_wps_rg_pin_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_AP_WPS_RG_PBC_OVERLAP, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NAN_STARTED, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NAN_STOPPED, void );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NAN_SVC_MATCH, wifi_event_nan_svc_match_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NAN_REPLIED, wifi_event_nan_replied_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NAN_RECEIVE, wifi_event_nan_receive_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NDP_INDICATION, wifi_event_ndp_indication_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NDP_CONFIRM, wifi_event_ndp_confirm_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_NDP_TERMINATED, wifi_event_ndp_terminated_t );
+CORE_EVENT_PAYLOAD( WIFI_EVENT_HOME_CHANNEL_CHANGE, wifi_event_home_channel_change_t );
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL( 5, 2, 0 )
+CORE_EVENT_PAYLOAD( WIFI_EVENT_STA_NEIGHBOR_REP, wifi_event_neighbor_report_t );
+#endif
+
+/*!< IP_EVENT, lost-ip events carry ip_event_got_ip_t with only esp_netif filled in */
+CORE_EVENT_PAYLOAD( IP_EVENT_STA_GOT_IP, ip_event_got_ip_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_STA_LOST_IP, ip_event_got_ip_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_AP_STAIPASSIGNED, ip_event_ap_staipassigned_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_GOT_IP6, ip_event_got_ip6_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_ETH_GOT_IP, ip_event_got_ip_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_ETH_LOST_IP, ip_event_got_ip_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_PPP_GOT_IP, ip_event_got_ip_t );
+CORE_EVENT_PAYLOAD( IP_EVENT_PPP_LOST_IP, ip_event_got_ip_t );
+
+#undef CORE_EVENT_PAYLOAD
+
+template < auto Id > using EventPayloadT = typename EventPayload< Id >::type;
+
+/*!< Maps the enum type of an event id to its event base */
+template < class IdType > struct EventBase;
+
+template <> struct EventBase< wifi_event_t > final {
+    static esp_event_base_t get() noexcept { return WIFI_EVENT; }
+};
+
+template <> struct EventBase< ip_event_t > final {
+    static esp_event_base_t get() noexcept { return IP_EVENT; }
+};
+
+template < class IdType >
+concept EventId = requires {
+    { EventBase< IdType >::get() } -> std::same_as< esp_event_base_t >;
+};
+
+/*!< Callbacks run in the event task, behind C frames, so they must not throw */
+template < class F, auto Id >
+concept EventCallback =
+( std::is_void_v< EventPayloadT< Id > > && std::is_nothrow_invocable_v< F > ) ||
+( !std::is_void_v< EventPayloadT< Id > > && std::is_nothrow_invocable_v< F, const EventPayloadT< Id > & > );
+
+/*!< A single entry of the handler table: event id and the callback invoked for it */
+template < auto Id, auto Callback >
+    requires EventCallback< decltype( Callback ), Id >
+struct On final {
+    using IdType  = decltype( Id );
+    using Payload = EventPayloadT< Id >;
+
+    static constexpr std::size_t index = static_cast< std::size_t >( Id );
+
+    static void invoke( void * data ) noexcept {
+        if constexpr ( std::is_void_v< Payload > )
+            Callback();
+        else
+            Callback( *static_cast< const Payload * >( data ) );
+    }
+};
+
+/*!
+ * Routes events of the default loop to callbacks fixed at compile time.
+ * One esp_event handler is registered per event base; it indexes a constexpr
+ * table of thunks by event id, so dispatch neither allocates nor type-erases.
+ *
+ * using Router = core::EventRouter< core::On< WIFI_EVENT_STA_DISCONNECTED, onDisconnected >,
+ *                                   core::On< IP_EVENT_STA_GOT_IP, onGotIp > >;
+ * Router::registerHandlers();
+ */
+template < class... Handlers > class EventRouter final {
+    using Thunk = void ( * )( void * ) noexcept;
+
+    struct BaseOps final {
+        esp_event_base_t ( *base )() noexcept;
+        esp_event_handler_t handler;
+    };
+
+    template < class IdType > static constexpr std::size_t tableSize() {
+        std::size_t size = 0;
+        ( [ & ] {
+            if constexpr ( std::same_as< IdType, typename Handlers::IdType > )
+                if ( Handlers::index + 1 > size )
+                    size = Handlers::index + 1;
+        }(),
+          ... );
+        return size;
+    }
+
+    template < class IdType > static constexpr auto makeTable() {
+        std::array< Thunk, tableSize< IdType >() > table {};
+        ( [ & ] {
+            if constexpr ( std::same_as< IdType, typename Handlers::IdType > )
+                table[ Handlers::index ] = &Handlers::invoke;
+        }(),
+          ... );
+        return table;
+    }
+
+    template < class Handler > static constexpr std::size_t routesOf() {
+        return ( std::size_t { std::same_as< typename Handler::IdType, typename Handlers::IdType > &&
+                               Handler::index == Handlers::index } +
+                 ... );
+    }
+
+    static_assert( sizeof...( Handlers ) > 0, "EventRouter requires at least one handler" );
+    static_assert( ( EventId< typename Handlers::IdType > && ... ), "Event id type has no EventBase mapping" );
+    static_assert( ( ( routesOf< Handlers >() == 1 ) && ... ), "Event id is routed more than once" );
+
+    template < class IdType > static constexpr auto table = makeTable< IdType >();
+
+    template < class IdType > static void dispatch( void *, esp_event_base_t, int32_t id, void * data ) noexcept {
+        if ( id < 0 || static_cast< std::size_t >( id ) >= table< IdType >.size() )
+            return;
+
+        if ( const Thunk thunk = table< IdType >[ id ] )
+            thunk( data );
+    }
+
+    /*!< Distinct event bases used by Handlers, in order of first appearance */
+    static constexpr auto makeBases() {
+        std::array< BaseOps, sizeof...( Handlers ) > ops {};
+        std::size_t                                  count = 0;
+        ( [ & ] {
+            const BaseOps op { &EventBase< typename Handlers::IdType >::get, &dispatch< typename Handlers::IdType > };
+            for ( std::size_t i = 0; i < count; ++i )
+                if ( ops[ i ].handler == op.handler )
+                    return;
+            ops[ count++ ] = op;
+        }(),
+          ... );
+
+        struct {
+            std::array< BaseOps, sizeof...( Handlers ) > ops;
+            std::size_t                                  count;
+        } res { ops, count };
+        return res;
+    }
+
+    static void unregisterBases( std::size_t count ) noexcept {
+        constexpr auto bases = makeBases();
+        for ( std::size_t i = 0; i < count; ++i )
+            esp_event_handler_unregister( bases.ops[ i ].base(), ESP_EVENT_ANY_ID, bases.ops[ i ].handler );
+    }
+
+public:
+    static void registerHandlers() {
+        if ( isRegistered )
+            return;
+
+        constexpr auto bases = makeBases();
+        std::size_t    i     = 0;
+        try {
+            for ( ; i < bases.count; ++i )
+                CHECK_THROW( esp_event_handler_register(
+                bases.ops[ i ].base(), ESP_EVENT_ANY_ID, bases.ops[ i ].handler, nullptr ) );
+        } catch ( ... ) {
+            unregisterBases( i );
+            throw;
+        }
+
+        isRegistered = true;
+    }
+
+    static void unregisterHandlers() noexcept {
+        if ( !isRegistered )
+            return;
+
+        unregisterBases( makeBases().count );
+
+        isRegistered = false;
+    }
+
+private:
+    inline static bool isRegistered = false;
+};
+
+}   // namespace core
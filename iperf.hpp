@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <lwip/sockets.h>
+#include <unistd.h>
+
+namespace core {
+
+/*!
+ * iperf-style client measuring against a peer on the network:
+ * TCP and UDP upload throughput, and UDP round-trip latency percentiles.
+ * The peer only has to discard TCP/UDP traffic (iperf -s, iperf -s -u)
+ * and echo UDP datagrams (e.g. socat UDP-RECVFROM:7,fork EXEC:cat).
+ */
+class Iperf final {
+    using Clock = std::chrono::steady_clock;
+
+    class Socket final {
+    public:
+        Socket( int domain, int type, int protocol ) : mFd( socket( domain, type, protocol ) ) {
+            if ( mFd < 0 )
+                throw std::system_error( errno, std::generic_category(), "Iperf socket" );
+        }
+
+        Socket( Socket && other ) noexcept : mFd( std::exchange( other.mFd, -1 ) ) {}
+        Socket( const Socket & ) = delete;
+
+        Socket & operator=( Socket && )      = delete;
+        Socket & operator=( const Socket & ) = delete;
+
+        ~Socket() noexcept {
+            if ( mFd >= 0 )
+                close( mFd );
+        }
+
+        operator int() const noexcept { return mFd; }
+
+    private:
+        int mFd { -1 };
+    };
+
+public:
+    struct Peer final {
+        const char *  address; /**< IPv4 address of the peer */
+        std::uint16_t tcpPort  = 5001; /**< Discards a TCP stream */
+        std::uint16_t udpPort  = 5001; /**< Discards UDP datagrams */
+        std::uint16_t echoPort = 7; /**< Echoes UDP datagrams back */
+    };
+
+    struct Settings final {
+        std::chrono::milliseconds duration { 10'000 }; /**< Per throughput test */
+        std::size_t               tcpBlockSize       = 8 * 1024;
+        std::size_t               udpDatagramSize    = 1470;
+        std::size_t               latencySamples     = 200;
+        std::size_t               latencyPayloadSize = 64;
+        std::chrono::milliseconds latencyTimeout { 500 }; /**< A sample is lost after this */
+    };
+
+    struct Latency final {
+        std::chrono::microseconds p50 {};
+        std::chrono::microseconds p90 {};
+        std::chrono::microseconds p99 {};
+        std::chrono::microseconds max {};
+        std::size_t               lost {};
+    };
+
+    struct Report final {
+        double  tcpMbps {};
+        double  udpMbps {}; /**< Sender side, datagrams dropped on the way are not subtracted */
+        Latency udpRtt {};
+    };
+
+    static double tcpThroughput( const Peer & peer, const Settings & settings ) {
+        Socket sock( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+        connectTo( sock, peer.address, peer.tcpPort );
+        setTimeout( sock, SO_SNDTIMEO, sendTimeout );
+
+        const std::vector< std::byte > block( settings.tcpBlockSize );
+
+        std::size_t bytes    = 0;
+        const auto  begin    = Clock::now();
+        const auto  deadline = begin + settings.duration;
+        while ( Clock::now() < deadline ) {
+            const auto sent = send( sock, block.data(), block.size(), 0 );
+            if ( sent >= 0 )
+                bytes += static_cast< std::size_t >( sent );
+            else if ( errno != EAGAIN && errno != EWOULDBLOCK )
+                throw std::system_error( errno, std::generic_category(), "Iperf TCP send" );
+        }
+
+        return toMbps( bytes, Clock::now() - begin );
+    }
+
+    static double udpThroughput( const Peer & peer, const Settings & settings ) {
+        Socket sock( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+        connectTo( sock, peer.address, peer.udpPort );
+
+        const std::vector< std::byte > datagram( settings.udpDatagramSize );
+
+        std::size_t bytes    = 0;
+        const auto  begin    = Clock::now();
+        const auto  deadline = begin + settings.duration;
+        while ( Clock::now() < deadline ) {
+            const auto sent = send( sock, datagram.data(), datagram.size(), 0 );
+            if ( sent >= 0 )
+                bytes += static_cast< std::size_t >( sent );
+            else if ( errno != ENOMEM && errno != ENOBUFS && errno != EAGAIN )
+                throw std::system_error( errno, std::generic_category(), "Iperf UDP send" );
+        }
+
+        return toMbps( bytes, Clock::now() - begin );
+    }
+
+    static Latency udpLatency( const Peer & peer, const Settings & settings ) {
+        Socket sock( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+        connectTo( sock, peer.address, peer.echoPort );
+        setTimeout( sock, SO_RCVTIMEO, settings.latencyTimeout );
+
+        std::vector< std::byte > request( std::max( settings.latencyPayloadSize, sizeof( std::uint32_t ) ) );
+        std::vector< std::byte > reply( request.size() );
+
+        std::vector< std::chrono::microseconds > rtt;
+        rtt.reserve( settings.latencySamples );
+
+        Latency res;
+        for ( std::uint32_t seq = 0; seq < settings.latencySamples; ++seq ) {
+            std::memcpy( request.data(), &seq, sizeof( seq ) );
+
+            const auto begin = Clock::now();
+            if ( send( sock, request.data(), request.size(), 0 ) < 0 ) {
+                ++res.lost;
+                continue;
+            }
+
+            bool received = false;
+            while ( !received && Clock::now() - begin < settings.latencyTimeout ) {
+                const auto len = recv( sock, reply.data(), reply.size(), 0 );
+                if ( len < 0 )
+                    break;
+
+                std::uint32_t echoed {};
+                if ( static_cast< std::size_t >( len ) >= sizeof( echoed ) )
+                    std::memcpy( &echoed, reply.data(), sizeof( echoed ) );
+                received = echoed == seq;
+            }
+
+            if ( received )
+                rtt.push_back( std::chrono::duration_cast< std::chrono::microseconds >( Clock::now() - begin ) );
+            else
+                ++res.lost;
+        }
+
+        if ( rtt.empty() )
+            return res;
+
+        std::sort( rtt.begin(), rtt.end() );
+        res.p50 = percentile( rtt, 50 );
+        res.p90 = percentile( rtt, 90 );
+        res.p99 = percentile( rtt, 99 );
+        res.max = rtt.back();
+
+        return res;
+    }
+
+    static Report run( const Peer & peer, const Settings & settings ) {
+        return { .tcpMbps = tcpThroughput( peer, settings ),
+                 .udpMbps = udpThroughput( peer, settings ),
+                 .udpRtt  = udpLatency( peer, settings ) };
+    }
+
+private:
+    /*!< Bounds a blocked TCP send, so a stalled peer can't hold the test past its duration */
+    static constexpr std::chrono::milliseconds sendTimeout { 100 };
+
+    static void setTimeout( int sock, int option, std::chrono::milliseconds value ) {
+        const auto us = std::chrono::duration_cast< std::chrono::microseconds >( value ).count();
+
+        timeval timeout {};
+        timeout.tv_sec  = static_cast< decltype( timeout.tv_sec ) >( us / 1'000'000 );
+        timeout.tv_usec = static_cast< decltype( timeout.tv_usec ) >( us % 1'000'000 );
+        if ( setsockopt( sock, SOL_SOCKET, option, &timeout, sizeof( timeout ) ) < 0 )
+            throw std::system_error( errno, std::generic_category(), "Iperf setsockopt timeout" );
+    }
+
+    static void connectTo( int sock, const char * address, std::uint16_t port ) {
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons( port );
+        if ( inet_pton( AF_INET, address, &addr.sin_addr ) != 1 )
+            throw std::system_error( EINVAL, std::generic_category(), "Iperf peer address" );
+
+        if ( connect( sock, reinterpret_cast< const sockaddr * >( &addr ), sizeof( addr ) ) < 0 )
+            throw std::system_error( errno, std::generic_category(), "Iperf connect" );
+    }
+
+    static double toMbps( std::size_t bytes, Clock::duration elapsed ) {
+        const double seconds = std::chrono::duration< double >( elapsed ).count();
+        return seconds > 0 ? static_cast< double >( bytes ) * 8 / seconds / 1e6 : 0;
+    }
+
+    /*!< Nearest-rank percentile of sorted samples */
+    static std::chrono::microseconds percentile( const std::vector< std::chrono::microseconds > & sorted,
+                                                 std::size_t                                      p ) {
+        const std::size_t rank = ( p * sorted.size() + 99 ) / 100;
+        return sorted[ rank > 0 ? rank - 1 : 0 ];
+    }
+};
+
+}   // namespace core
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
@@ -13,6 +15,7 @@
 #include <utility>
 
 #include "esp_netif_types.h"
+#include "event.hpp"
 #include "nvsFlash.hpp"
 #include "netif.hpp"
 
@@ -47,6 +50,38 @@ public:
         eMax = WIFI_IF_MAX
     };
 
+    enum class PowerSave : std::underlying_type_t< wifi_ps_type_t > {
+        eNone     = WIFI_PS_NONE, /**< No power save */
+        eMinModem = WIFI_PS_MIN_MODEM, /**< Wake up every DTIM period */
+        eMaxModem = WIFI_PS_MAX_MODEM /**< Wake up every listen interval */
+    };
+
+    enum class Bandwidth : std::underlying_type_t< wifi_bandwidth_t > {
+        eHt20 = WIFI_BW_HT20,
+        eHt40 = WIFI_BW_HT40
+    };
+
+    enum class StaState : std::uint8_t {
+        eDisconnected,
+        eConnecting,
+        eConnected, /**< Associated with the AP, no IP yet */
+        eGotIp
+    };
+
+    enum class Profile {
+        eMaxThroughput, /**< Large buffer pools, 32/32 AMPDU windows, HT40, no power save */
+        eLowLatency, /**< No TX aggregation, small RX window, HT20, no power save */
+        eLowPower /**< Small buffer pools, HT20, max modem sleep, reduced TX power */
+    };
+
+    /*!< Runtime part of a profile, applied with esp_wifi_set_* once the driver is running.
+         The protocol bitmap is left at the target default, so 11ax stays enabled where supported */
+    struct ProfileParams final {
+        PowerSave   powerSave;
+        Bandwidth   bandwidth;
+        std::int8_t maxTxPower; /**< In 0.25 dBm units */
+    };
+
     static void init() {
         if ( isInited )
             return;
@@ -72,7 +107,71 @@ public:
         isInited = true;
     }
 
+    static void init( Profile profile ) { init( makeInitConfig( profile ) ); }
+
+    /*!< The TX buffer type is kept from CONFIG_ESP_WIFI_TX_BUFFER;
+         dynamic_tx_buf_num only takes effect with dynamic TX buffers */
+    static wifi_init_config_t makeInitConfig( Profile profile ) {
+        wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+
+        switch ( profile ) {
+        case Profile::eMaxThroughput:
+            cfg.static_rx_buf_num  = 16;
+            cfg.dynamic_rx_buf_num = 64;
+            cfg.dynamic_tx_buf_num = 64;
+            cfg.ampdu_rx_enable    = 1;
+            cfg.ampdu_tx_enable    = 1;
+            cfg.tx_ba_win          = 32;
+            cfg.rx_ba_win          = 32;
+            break;
+        case Profile::eLowLatency:
+            cfg.static_rx_buf_num  = 10;
+            cfg.dynamic_rx_buf_num = 32;
+            cfg.dynamic_tx_buf_num = 32;
+            cfg.ampdu_rx_enable    = 1;
+            cfg.ampdu_tx_enable    = 0;
+            cfg.rx_ba_win          = 6;
+            break;
+        case Profile::eLowPower:
+            cfg.static_rx_buf_num  = 4;
+            cfg.dynamic_rx_buf_num = 16;
+            cfg.dynamic_tx_buf_num = 16;
+            cfg.ampdu_rx_enable    = 1;
+            cfg.ampdu_tx_enable    = 0;
+            cfg.rx_ba_win          = 6;
+            break;
+        }
+
+        return cfg;
+    }
+
+    static constexpr ProfileParams profileParams( Profile profile ) noexcept {
+        switch ( profile ) {
+        case Profile::eMaxThroughput:
+            return { PowerSave::eNone, Bandwidth::eHt40, 84 };
+        case Profile::eLowLatency:
+            return { PowerSave::eNone, Bandwidth::eHt20, 84 };
+        case Profile::eLowPower:
+            return { PowerSave::eMaxModem, Bandwidth::eHt20, 34 };
+        }
+
+        __builtin_unreachable();
+    }
+
+    /*!< Must be called after start(): TX power can't be set while the driver is stopped */
+    static void applyProfile( Interface interface, Profile profile ) {
+        const ProfileParams params = profileParams( profile );
+
+        setBandwidth( interface, params.bandwidth );
+        setPowerSave( params.powerSave );
+        setMaxTxPower( params.maxTxPower );
+    }
+
     static void deinit() noexcept {
+        StaEvents::unregisterHandlers();
+        autoReconnect = false;
+        staState      = StaState::eDisconnected;
+
         ESP_ERROR_CHECK( esp_wifi_deinit() );
         isInited = false;
     }
@@ -80,13 +179,16 @@ public:
     static void start() { CHECK_THROW( esp_wifi_start() ); }
     static void stop() { CHECK_THROW( esp_wifi_stop() ); }
 
+    /*!< Pass makeInitConfig( profile ) as initCfg to keep a profile's buffer and AMPDU settings */
     template < class DefaultProvider >
         requires requires {
             { DefaultProvider::init() } -> std::same_as< esp_netif_t * >;
             requires std::same_as< const WifiMode, decltype( DefaultProvider::wifimode ) >;
             requires std::same_as< const Interface, decltype( DefaultProvider::interface ) >;
         }
-    static void createDefault( wifi_config_t & cfg, Storage storage ) {
+    static void createDefault( wifi_config_t &            cfg,
+                               Storage                    storage,
+                               const wifi_init_config_t & initCfg = WIFI_INIT_CONFIG_DEFAULT() ) {
         if ( isInited )
             deinit();
 
@@ -95,7 +197,7 @@ public:
 
         DefaultProvider::init();
 
-        init();
+        init( initCfg );
         setMode( DefaultProvider::wifimode );
         setConfig( DefaultProvider::interface, cfg );
         setStorage( storage );
@@ -107,7 +209,10 @@ public:
             requires std::same_as< const WifiMode, decltype( DefaultProvider::wifimode ) >;
             requires std::same_as< const Interface, decltype( DefaultProvider::interface ) >;
         }
-    [[nodiscard]] static core::NetIfHandler createDefaultWithHandler( wifi_config_t & cfg, Storage storage ) {
+    [[nodiscard]] static core::NetIfHandler
+    createDefaultWithHandler( wifi_config_t &            cfg,
+                              Storage                    storage,
+                              const wifi_init_config_t & initCfg = WIFI_INIT_CONFIG_DEFAULT() ) {
         if ( isInited )
             deinit();
 
@@ -116,7 +221,7 @@ public:
 
         core::NetIfHandler res = core::NetIf::createHandler( DefaultProvider::init(), NetIfDefaultWifiDeleter() );
 
-        init();
+        init( initCfg );
         setMode( DefaultProvider::wifimode );
         setConfig( DefaultProvider::interface, cfg );
         setStorage( storage );
@@ -124,8 +229,30 @@ public:
         return res;
     }
 
-    static void connect() {}
-    static void disconnect() {}
+    /*!< Starts STA association; a dropped link is re-established up to maxReconnectAttempts times in a row,
+         but never after an authentication failure, until disconnect() */
+    static void connect() {
+        StaEvents::registerHandlers();
+
+        reconnectAttempts = 0;
+        autoReconnect     = true;
+        staState          = StaState::eConnecting;
+
+        if ( const esp_err_t err = esp_wifi_connect(); err != ESP_OK ) {
+            autoReconnect = false;
+            staState      = StaState::eDisconnected;
+            CHECK_THROW( err );
+        }
+    }
+
+    static void disconnect() {
+        autoReconnect = false;
+        CHECK_THROW( esp_wifi_disconnect() );
+    }
+
+    static StaState getStaState() noexcept { return staState; }
+
+    static wifi_err_reason_t getLastDisconnectReason() noexcept { return lastDisconnectReason; }
 
     static void setConfig( Interface interface, wifi_config_t & cfg ) {
         CHECK_THROW( esp_wifi_set_config( static_cast< wifi_interface_t >( interface ), &cfg ) );
@@ -143,8 +270,95 @@ public:
         CHECK_THROW( esp_wifi_set_storage( static_cast< wifi_storage_t >( storage ) ) );
     }
 
+    static void setPowerSave( PowerSave ps ) { CHECK_THROW( esp_wifi_set_ps( static_cast< wifi_ps_type_t >( ps ) ) ); }
+
+    static PowerSave getPowerSave() {
+        wifi_ps_type_t ps;
+        CHECK_THROW( esp_wifi_get_ps( &ps ) );
+        return static_cast< PowerSave >( ps );
+    }
+
+    static void setBandwidth( Interface interface, Bandwidth bw ) {
+        CHECK_THROW(
+        esp_wifi_set_bandwidth( static_cast< wifi_interface_t >( interface ), static_cast< wifi_bandwidth_t >( bw ) ) );
+    }
+
+    static Bandwidth getBandwidth( Interface interface ) {
+        wifi_bandwidth_t bw;
+        CHECK_THROW( esp_wifi_get_bandwidth( static_cast< wifi_interface_t >( interface ), &bw ) );
+        return static_cast< Bandwidth >( bw );
+    }
+
+    static void setProtocol( Interface interface, std::uint8_t protocolBitmap ) {
+        CHECK_THROW( esp_wifi_set_protocol( static_cast< wifi_interface_t >( interface ), protocolBitmap ) );
+    }
+
+    static std::uint8_t getProtocol( Interface interface ) {
+        std::uint8_t protocolBitmap;
+        CHECK_THROW( esp_wifi_get_protocol( static_cast< wifi_interface_t >( interface ), &protocolBitmap ) );
+        return protocolBitmap;
+    }
+
+    static void setMaxTxPower( std::int8_t power ) { CHECK_THROW( esp_wifi_set_max_tx_power( power ) ); }
+
+    static std::int8_t getMaxTxPower() {
+        std::int8_t power;
+        CHECK_THROW( esp_wifi_get_max_tx_power( &power ) );
+        return power;
+    }
+
+    static constexpr std::uint8_t maxReconnectAttempts = 5;
+
 private:
-    inline static bool isInited = false;
+    static constexpr bool isAuthFailure( wifi_err_reason_t reason ) noexcept {
+        switch ( reason ) {
+        case WIFI_REASON_AUTH_FAIL:
+        case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+        case WIFI_REASON_HANDSHAKE_TIMEOUT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static void onStaConnected( const wifi_event_sta_connected_t & ) noexcept { staState = StaState::eConnected; }
+
+    static void onStaDisconnected( const wifi_event_sta_disconnected_t & event ) noexcept {
+        const auto reason    = static_cast< wifi_err_reason_t >( event.reason );
+        lastDisconnectReason = reason;
+
+        if ( isAuthFailure( reason ) || reconnectAttempts >= maxReconnectAttempts )
+            autoReconnect = false;
+
+        if ( autoReconnect && esp_wifi_connect() == ESP_OK ) {
+            ++reconnectAttempts;
+            staState = StaState::eConnecting;
+        } else {
+            autoReconnect = false;
+            staState      = StaState::eDisconnected;
+        }
+    }
+
+    static void onStaGotIp( const ip_event_got_ip_t & ) noexcept {
+        reconnectAttempts = 0;
+        staState          = StaState::eGotIp;
+    }
+
+    static void onStaLostIp( const ip_event_got_ip_t & ) noexcept {
+        StaState expected = StaState::eGotIp;
+        staState.compare_exchange_strong( expected, StaState::eConnected );
+    }
+
+    using StaEvents = core::EventRouter< core::On< WIFI_EVENT_STA_CONNECTED, &Wifi::onStaConnected >,
+                                         core::On< WIFI_EVENT_STA_DISCONNECTED, &Wifi::onStaDisconnected >,
+                                         core::On< IP_EVENT_STA_GOT_IP, &Wifi::onStaGotIp >,
+                                         core::On< IP_EVENT_STA_LOST_IP, &Wifi::onStaLostIp > >;
+
+    inline static bool                             isInited = false;
+    inline static std::atomic< bool >              autoReconnect { false };
+    inline static std::atomic< std::uint8_t >      reconnectAttempts { 0 };
+    inline static std::atomic< StaState >          staState { StaState::eDisconnected };
+    inline static std::atomic< wifi_err_reason_t > lastDisconnectReason { WIFI_REASON_UNSPECIFIED };
 };
 
 struct ApProvider final {
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+#include <esp_wifi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "iperf.hpp"
+#include "netif.hpp"
+#include "wifi.hpp"
+
+namespace Connect {
+
+/*!< Runs core::Iperf over a STA link brought up once per Wifi::Profile */
+class WifiIperf final {
+    /*!< Stops the driver before the STA netif it was created with is destroyed */
+    struct Session final {
+        Session( const Session & )             = delete;
+        Session & operator=( const Session & ) = delete;
+
+        Session() { Wifi::start(); }
+
+        /*!< Wifi::disconnect() disarms auto-reconnect, so no reconnect races the stop */
+        ~Session() noexcept {
+            try {
+                Wifi::disconnect();
+            } catch ( ... ) {
+            }
+            try {
+                Wifi::stop();
+            } catch ( ... ) {
+            }
+            Wifi::deinit();
+        }
+    };
+
+public:
+    static constexpr std::array< Wifi::Profile, 3 > profiles {
+        Wifi::Profile::eMaxThroughput, Wifi::Profile::eLowLatency, Wifi::Profile::eLowPower
+    };
+
+    struct ProfileReport final {
+        Wifi::Profile      profile;
+        core::Iperf::Report report;
+    };
+
+    static core::Iperf::Report runProfile( wifi_config_t &               cfg,
+                                           Wifi::Profile                 profile,
+                                           const core::Iperf::Peer &     peer,
+                                           const core::Iperf::Settings & settings,
+                                           std::chrono::milliseconds     connectTimeout = std::chrono::seconds( 30 ) ) {
+        const core::NetIfHandler netif =
+        Wifi::createDefaultWithHandler< StaProvider >( cfg, Wifi::Storage::eRam, Wifi::makeInitConfig( profile ) );
+        const Session session;
+
+        Wifi::applyProfile( Wifi::Interface::eSta, profile );
+        Wifi::connect();
+        waitForIp( connectTimeout );
+
+        return core::Iperf::run( peer, settings );
+    }
+
+    static std::array< ProfileReport, profiles.size() >
+    runProfiles( wifi_config_t &               cfg,
+                 const core::Iperf::Peer &     peer,
+                 const core::Iperf::Settings & settings,
+                 std::chrono::milliseconds     connectTimeout = std::chrono::seconds( 30 ) ) {
+        std::array< ProfileReport, profiles.size() > res {};
+        for ( std::size_t i = 0; i < profiles.size(); ++i )
+            res[ i ] = { profiles[ i ], runProfile( cfg, profiles[ i ], peer, settings, connectTimeout ) };
+
+        return res;
+    }
+
+private:
+    static void waitForIp( std::chrono::milliseconds timeout ) {
+        constexpr std::chrono::milliseconds pollPeriod { 100 };
+
+        for ( auto waited = std::chrono::milliseconds::zero(); Wifi::getStaState() != Wifi::StaState::eGotIp;
+              waited += pollPeriod ) {
+            if ( waited >= timeout )
+                throw std::runtime_error( "WifiIperf: STA got no IP in time!!!" );
+            vTaskDelay( pdMS_TO_TICKS( pollPeriod.count() ) );
+        }
+    }
+};
+
+}   // namespace Connect